@@ -0,0 +1,549 @@
+#include "wordle.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#define SIMULATED_OPENERS 10 // Top openers per strategy replayed as full games
+#define RANKED_OPENERS 25    // Openers per strategy written to the book
+#define ALL_GREEN_INDEX (FEEDBACK_PATTERNS - 1)
+
+static const char *strategy_names[STRATEGY_COUNT] = {"simple", "minimax"};
+
+// Analysis result for one first guess under one strategy
+typedef struct {
+  int word_index;
+  int worst_case;     // Largest group left after the opener and best reply
+  double expected;    // Expected group size left after the opener and reply
+  double avg_guesses; // Average guesses over all targets (simulated only)
+  int failures;       // Games not solved within MAX_GUESSES (simulated only)
+  bool simulated;
+} OpenerScore;
+
+// Per-thread scratch space for scoring openers
+typedef struct {
+  int *members;                     // Targets grouped by first-turn pattern
+  int start[FEEDBACK_PATTERNS + 1]; // Offset of each pattern's group
+  bool *in_group;                   // Marks members of the current group
+  int counts[FEEDBACK_PATTERNS];    // Feedback buckets, kept zeroed
+} Workspace;
+
+/**
+ * Precomputes the feedback index of every (guess, target) pair so the sweep
+ * never calls get_feedback in its inner loops.
+ * @return Table where entry [guess * word_count + target] is the pattern, or
+ * NULL if it does not fit in memory.
+ */
+static unsigned char *build_pattern_table(char **word_list, int word_count) {
+  unsigned char *table = malloc((size_t)word_count * word_count);
+  if (!table)
+    return NULL;
+
+OMP_PRAGMA(omp parallel for schedule(static))
+  for (int g = 0; g < word_count; g++) {
+    FeedbackColor feedback[WORD_LENGTH];
+    unsigned char *row = table + (size_t)g * word_count;
+    for (int t = 0; t < word_count; t++) {
+      get_feedback(word_list[t], word_list[g], feedback);
+      row[t] = (unsigned char)get_feedback_index(feedback);
+    }
+  }
+  return table;
+}
+
+// Splits a group by the reply's feedback. Gives up (returns false) as soon as
+// a bucket grows beyond limit, since the reply can no longer be the best.
+static bool score_reply(const unsigned char *row, const int *group, int size,
+                        int limit, int *counts, int *worst, long *sum_sq) {
+  int max_count = 0;
+  long squares = 0;
+  bool within_limit = true;
+  int k = 0;
+
+  while (k < size) {
+    int c = ++counts[row[group[k++]]];
+    squares += 2 * c - 1;
+    if (c > max_count) {
+      max_count = c;
+      if (max_count > limit) {
+        within_limit = false;
+        break;
+      }
+    }
+  }
+
+  for (int j = 0; j < k; j++)
+    counts[row[group[j]]] = 0;
+
+  *worst = max_count;
+  *sum_sq = squares;
+  return within_limit;
+}
+
+/**
+ * Finds the best second guess for one group of targets: smallest worst case,
+ * then smallest expected group, then a possible answer, then lowest index.
+ * @param any_word true to try every dictionary word (Minimax), false to try
+ * only the group's own words (Simple only guesses consistent words).
+ * @return Index of the best reply.
+ */
+static int find_best_reply(const unsigned char *table, int word_count,
+                           const int *group, int size, const bool *in_group,
+                           bool any_word, int *counts, int *out_worst,
+                           long *out_sum_sq) {
+  int best = group[0];
+  int best_worst = size + 1;
+  long best_sum_sq = 0;
+
+  // Group members first: a member that splits the group into singletons is
+  // optimal, and the members are in index order.
+  int candidates = any_word ? size + word_count : size;
+  for (int k = 0; k < candidates; k++) {
+    int r = (k < size) ? group[k] : k - size;
+    if (k >= size && in_group[r])
+      continue;
+
+    int worst;
+    long sum_sq;
+    if (!score_reply(table + (size_t)r * word_count, group, size, best_worst,
+                     counts, &worst, &sum_sq))
+      continue;
+
+    bool better = worst < best_worst ||
+                  (worst == best_worst && sum_sq < best_sum_sq) ||
+                  (worst == best_worst && sum_sq == best_sum_sq &&
+                   (in_group[r] != in_group[best] ? in_group[r] : r < best));
+    if (better) {
+      best = r;
+      best_worst = worst;
+      best_sum_sq = sum_sq;
+    }
+
+    if (best_worst == 1 && in_group[best])
+      break;
+  }
+
+  *out_worst = best_worst;
+  *out_sum_sq = best_sum_sq;
+  return best;
+}
+
+/**
+ * Scores one first guess under every strategy: groups the targets by the
+ * opener's feedback and picks the best reply for each group.
+ * @param openings If not NULL, receives the opener and replies per strategy.
+ */
+static void score_opener(const unsigned char *table, char **word_list,
+                         int word_count, int opener, Workspace *ws,
+                         OpenerScore *scores, Opening *openings) {
+  const unsigned char *row = table + (size_t)opener * word_count;
+
+  // Counting sort of the targets by pattern
+  memset(ws->start, 0, sizeof(ws->start));
+  for (int t = 0; t < word_count; t++)
+    ws->start[row[t] + 1]++;
+  for (int p = 0; p < FEEDBACK_PATTERNS; p++)
+    ws->start[p + 1] += ws->start[p];
+  int fill[FEEDBACK_PATTERNS];
+  memcpy(fill, ws->start, sizeof(fill));
+  for (int t = 0; t < word_count; t++)
+    ws->members[fill[row[t]]++] = t;
+
+  for (int s = 0; s < STRATEGY_COUNT; s++) {
+    scores[s].word_index = opener;
+    scores[s].worst_case = 0;
+    scores[s].simulated = false;
+    long total_sum_sq = 0;
+
+    if (openings) {
+      memset(&openings[s], 0, sizeof(Opening));
+      strcpy(openings[s].opener, word_list[opener]);
+      openings[s].loaded = true;
+    }
+
+    for (int p = 0; p < FEEDBACK_PATTERNS; p++) {
+      int size = ws->start[p + 1] - ws->start[p];
+      // The all-green group is the opener itself, already solved
+      if (size == 0 || p == ALL_GREEN_INDEX)
+        continue;
+
+      const int *group = ws->members + ws->start[p];
+      for (int k = 0; k < size; k++)
+        ws->in_group[group[k]] = true;
+
+      int worst;
+      long sum_sq;
+      int reply = find_best_reply(table, word_count, group, size, ws->in_group,
+                                  s == STRATEGY_MINIMAX, ws->counts, &worst,
+                                  &sum_sq);
+
+      for (int k = 0; k < size; k++)
+        ws->in_group[group[k]] = false;
+
+      if (worst > scores[s].worst_case)
+        scores[s].worst_case = worst;
+      total_sum_sq += sum_sq;
+      if (openings)
+        strcpy(openings[s].replies[p], word_list[reply]);
+    }
+
+    scores[s].expected = (double)total_sum_sq / word_count;
+  }
+}
+
+static bool init_workspace(Workspace *ws, int word_count) {
+  ws->members = malloc(word_count * sizeof(int));
+  ws->in_group = calloc(word_count, sizeof(bool));
+  memset(ws->counts, 0, sizeof(ws->counts));
+  return ws->members && ws->in_group;
+}
+
+static void free_workspace(Workspace *ws) {
+  free(ws->members);
+  free(ws->in_group);
+}
+
+// Ranks by the two-guess analysis: expected group size, then worst case.
+static int compare_expected(const void *a, const void *b) {
+  const OpenerScore *x = a;
+  const OpenerScore *y = b;
+  if (x->expected != y->expected)
+    return (x->expected < y->expected) ? -1 : 1;
+  if (x->worst_case != y->worst_case)
+    return x->worst_case - y->worst_case;
+  return x->word_index - y->word_index;
+}
+
+// Ranks simulated openers: failures, then average guesses.
+static int compare_simulated(const void *a, const void *b) {
+  const OpenerScore *x = a;
+  const OpenerScore *y = b;
+  if (x->failures != y->failures)
+    return x->failures - y->failures;
+  if (x->avg_guesses != y->avg_guesses)
+    return (x->avg_guesses < y->avg_guesses) ? -1 : 1;
+  return compare_expected(a, b);
+}
+
+// Plays every target with the given opening and records the results.
+static void simulate_opening(SolverStrategy strategy, const Opening *opening,
+                             char **word_list, int word_count,
+                             OpenerScore *score) {
+  long long total_guesses = 0;
+  int failures = 0;
+
+OMP_PRAGMA(omp parallel for schedule(dynamic, 16) reduction(+ : total_guesses, failures))
+  for (int t = 0; t < word_count; t++) {
+    int g = solve_game_with_opening(strategy, word_list[t], word_list,
+                                    word_count, opening, 0, NULL, NULL);
+    if (g > MAX_GUESSES)
+      failures++;
+    else
+      total_guesses += g;
+  }
+
+  score->simulated = true;
+  score->failures = failures;
+  score->avg_guesses = (failures == word_count)
+                           ? 0
+                           : (double)total_guesses / (word_count - failures);
+}
+
+// Writes a feedback index as the solver's G/Y/- notation.
+static void pattern_to_string(int index, char *out) {
+  for (int i = 0; i < WORD_LENGTH; i++) {
+    int color = index % 3;
+    out[i] = (color == COLOR_GREEN) ? 'G' : (color == COLOR_YELLOW) ? 'Y' : '-';
+    index /= 3;
+  }
+  out[WORD_LENGTH] = '\0';
+}
+
+// Parses G/Y/- notation back into a feedback index; -1 if malformed.
+static int pattern_from_string(const char *str) {
+  if (strlen(str) != WORD_LENGTH)
+    return -1;
+  FeedbackColor feedback[WORD_LENGTH];
+  for (int i = 0; i < WORD_LENGTH; i++) {
+    if (str[i] == 'G')
+      feedback[i] = COLOR_GREEN;
+    else if (str[i] == 'Y')
+      feedback[i] = COLOR_YELLOW;
+    else if (str[i] == '-')
+      feedback[i] = COLOR_GRAY;
+    else
+      return -1;
+  }
+  return get_feedback_index(feedback);
+}
+
+static bool write_opening_book(const char *filename, char **word_list,
+                               int word_count,
+                               OpenerScore *ranked[STRATEGY_COUNT],
+                               const Opening *best) {
+  FILE *f = fopen(filename, "w");
+  if (!f)
+    return false;
+
+  fprintf(f, "# Wordle opening book, generated by the opener analysis.\n");
+  fprintf(f, "# opener: rank word worst_case expected_left avg_guesses "
+             "failures\n");
+  fprintf(f, "# reply: first-turn feedback and the second guess to play\n");
+  fprintf(f, "# words: dictionary size and FNV-1a fingerprint\n");
+  fprintf(f, "words %d %016llx\n", word_count,
+          word_list_fingerprint(word_list, word_count));
+
+  int listed = (word_count < RANKED_OPENERS) ? word_count : RANKED_OPENERS;
+  for (int s = 0; s < STRATEGY_COUNT; s++) {
+    fprintf(f, "strategy %s\n", strategy_names[s]);
+    for (int r = 0; r < listed; r++) {
+      const OpenerScore *score = &ranked[s][r];
+      fprintf(f, "opener %d %s %d %.3f ", r + 1,
+              word_list[score->word_index], score->worst_case,
+              score->expected);
+      if (score->simulated)
+        fprintf(f, "%.4f %d\n", score->avg_guesses, score->failures);
+      else
+        fprintf(f, "- -\n");
+    }
+    for (int p = 0; p < FEEDBACK_PATTERNS; p++) {
+      if (!best[s].replies[p][0])
+        continue;
+      char pattern[WORD_LENGTH + 1];
+      pattern_to_string(p, pattern);
+      fprintf(f, "reply %s %s\n", pattern, best[s].replies[p]);
+    }
+  }
+
+  fclose(f);
+  return true;
+}
+
+/**
+ * Exhaustively scores every first guess, and the best reply to each
+ * first-turn feedback, for both strategies. The top openers are then replayed
+ * against every target, and the ranking is written to an opening book.
+ * @param word_list The dictionary (also used as the set of targets).
+ * @param word_count The number of words in the dictionary.
+ * @param filename Where to write the opening book.
+ * @return true if the analysis completed and the book was written.
+ */
+bool run_opener_analysis(char **word_list, int word_count,
+                         const char *filename) {
+  if (word_count == 0)
+    return false;
+
+  int threads = 1;
+#ifdef _OPENMP
+  threads = omp_get_max_threads();
+#endif
+  double start = get_time_ms();
+
+  printf("Precomputing %d x %d feedback table...\n", word_count, word_count);
+  unsigned char *table = build_pattern_table(word_list, word_count);
+  if (!table) {
+    fprintf(stderr, "Not enough memory for the feedback table.\n");
+    return false;
+  }
+
+  OpenerScore *scores[STRATEGY_COUNT];
+  for (int s = 0; s < STRATEGY_COUNT; s++)
+    scores[s] = malloc(word_count * sizeof(OpenerScore));
+
+  printf("Scoring %d openers on %d thread(s)...\n[", word_count, threads);
+  fflush(stdout);
+  int done = 0;
+  bool ok = true;
+
+OMP_PRAGMA(omp parallel)
+  {
+    Workspace ws;
+    bool have_ws = init_workspace(&ws, word_count);
+    if (!have_ws) {
+OMP_PRAGMA(omp atomic write)
+      ok = false;
+    }
+
+OMP_PRAGMA(omp for schedule(dynamic, 4))
+    for (int g = 0; g < word_count; g++) {
+      if (!have_ws)
+        continue;
+      OpenerScore result[STRATEGY_COUNT];
+      score_opener(table, word_list, word_count, g, &ws, result, NULL);
+      for (int s = 0; s < STRATEGY_COUNT; s++)
+        scores[s][g] = result[s];
+
+OMP_PRAGMA(omp critical)
+      {
+        done++;
+        if (done % (word_count / 10 + 1) == 0) {
+          printf("#");
+          fflush(stdout);
+        }
+      }
+    }
+
+    free_workspace(&ws);
+  }
+  printf("] Done.\n");
+
+  Opening best[STRATEGY_COUNT];
+  Workspace ws;
+  if (ok)
+    ok = init_workspace(&ws, word_count);
+
+  for (int s = 0; ok && s < STRATEGY_COUNT; s++) {
+    qsort(scores[s], word_count, sizeof(OpenerScore), compare_expected);
+
+    int top = (word_count < SIMULATED_OPENERS) ? word_count : SIMULATED_OPENERS;
+    printf("Replaying top %d %s openers against all targets...\n", top,
+           strategy_names[s]);
+    for (int r = 0; r < top; r++) {
+      OpenerScore result[STRATEGY_COUNT];
+      Opening openings[STRATEGY_COUNT];
+      score_opener(table, word_list, word_count, scores[s][r].word_index, &ws,
+                   result, openings);
+      simulate_opening(s, &openings[s], word_list, word_count, &scores[s][r]);
+    }
+    qsort(scores[s], top, sizeof(OpenerScore), compare_simulated);
+
+    OpenerScore result[STRATEGY_COUNT];
+    Opening openings[STRATEGY_COUNT];
+    score_opener(table, word_list, word_count, scores[s][0].word_index, &ws,
+                 result, openings);
+    best[s] = openings[s];
+  }
+  if (ok)
+    free_workspace(&ws);
+  free(table);
+
+  if (ok) {
+    printf("\n--- Opener Analysis (%.1f s) ---\n",
+           (get_time_ms() - start) / 1000.0);
+    for (int s = 0; s < STRATEGY_COUNT; s++) {
+      printf("\n%s:\nRank | Opener | Worst Case | Expected Left | Avg Guesses "
+             "| Failures\n",
+             strategy_names[s]);
+      for (int r = 0; r < 5 && r < word_count; r++) {
+        const OpenerScore *score = &scores[s][r];
+        printf("%4d | %6s | %10d | %13.3f | %11.4f | %8d\n", r + 1,
+               word_list[score->word_index], score->worst_case, score->expected,
+               score->avg_guesses, score->failures);
+      }
+    }
+
+    ok = write_opening_book(filename, word_list, word_count, scores, best);
+    if (ok)
+      printf("\nOpening book written to %s; it is used from the next run.\n",
+             filename);
+    else
+      fprintf(stderr, "Failed to write %s\n", filename);
+  } else {
+    fprintf(stderr, "Not enough memory for the opener analysis.\n");
+  }
+
+  for (int s = 0; s < STRATEGY_COUNT; s++)
+    free(scores[s]);
+  return ok;
+}
+
+/**
+ * Loads an opening book and installs it in the solvers. The book is ignored,
+ * with a message, if its word count and fingerprint do not match the
+ * dictionary or its entries are invalid.
+ * @param filename The opening book written by run_opener_analysis.
+ * @param word_list The dictionary in use.
+ * @param word_count The number of words in the dictionary.
+ * @return true if at least one strategy's opening was installed.
+ */
+bool load_opening_book(const char *filename, char **word_list, int word_count) {
+  FILE *f = fopen(filename, "r");
+  if (!f)
+    return false;
+
+  Opening openings[STRATEGY_COUNT];
+  memset(openings, 0, sizeof(openings));
+  int current = -1;
+  bool matched = false; // Saw a words line matching this dictionary
+  bool valid = true;
+  char line[256];
+
+  while (valid && fgets(line, sizeof(line), f)) {
+    char key[16], a[16], b[16];
+    int rank;
+
+    if (line[0] == '#' || sscanf(line, "%15s", key) != 1)
+      continue;
+
+    if (strcmp(key, "words") == 0) {
+      int book_words;
+      unsigned long long fingerprint;
+      matched = sscanf(line, "words %d %llx", &book_words, &fingerprint) == 2 &&
+                book_words == word_count &&
+                fingerprint == word_list_fingerprint(word_list, word_count);
+      if (!matched) {
+        fprintf(stderr,
+                "Ignoring %s: it was generated for a different word list. "
+                "Re-run the opener analysis.\n",
+                filename);
+        fclose(f);
+        return false;
+      }
+    } else if (strcmp(key, "strategy") == 0) {
+      current = -1;
+      if (sscanf(line, "strategy %15s", a) == 1) {
+        for (int s = 0; s < STRATEGY_COUNT; s++) {
+          if (strcmp(a, strategy_names[s]) == 0)
+            current = s;
+        }
+      }
+    } else if (current >= 0 && strcmp(key, "opener") == 0) {
+      if (sscanf(line, "opener %d %15s", &rank, a) != 2)
+        valid = false;
+      else if (rank == 1) {
+        valid = is_valid_word(a, word_list, word_count);
+        if (valid) {
+          strcpy(openings[current].opener, a);
+          openings[current].loaded = true;
+        }
+      }
+    } else if (current >= 0 && strcmp(key, "reply") == 0) {
+      int p = -1;
+      if (sscanf(line, "reply %15s %15s", a, b) == 2)
+        p = pattern_from_string(a);
+      valid = p >= 0 && is_valid_word(b, word_list, word_count);
+      if (valid)
+        strcpy(openings[current].replies[p], b);
+    }
+  }
+  fclose(f);
+
+  // Simple only guesses consistent words: each reply must fit its feedback
+  const Opening *simple = &openings[STRATEGY_SIMPLE];
+  for (int p = 0; valid && simple->loaded && p < FEEDBACK_PATTERNS; p++) {
+    if (!simple->replies[p][0])
+      continue;
+    FeedbackColor feedback[WORD_LENGTH];
+    get_feedback(simple->replies[p], simple->opener, feedback);
+    valid = get_feedback_index(feedback) == p;
+  }
+
+  if (!matched || !valid) {
+    fprintf(stderr, "Ignoring %s: %s.\n", filename,
+            matched ? "malformed or inconsistent entries"
+                    : "missing word list fingerprint");
+    return false;
+  }
+
+  bool any = false;
+  for (int s = 0; s < STRATEGY_COUNT; s++) {
+    if (openings[s].loaded) {
+      set_solver_opening(s, &openings[s]);
+      any = true;
+    }
+  }
+  return any;
+}
@@ -0,0 +1,394 @@
+#include "wordle.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Microbenchmarks for the core kernels. Build separately from the game:
+//   gcc -O2 -fopenmp bench.c game.c utils.c solver.c -o bench.exe
+// Usage:
+//   bench.exe [--words FILE] [--reps N] [--save FILE] [--compare FILE]
+//             [--threshold PCT]
+
+#define BENCH_SEED 0x9E3779B97F4A7C15ULL // Fixed seed for reproducible inputs
+#define BENCH_PAIRS 4096                 // Word pairs per feedback batch
+#define BENCH_SPLIT_GUESSES 16           // Guesses per worst-case-split batch
+#define BENCH_WARMUP_REPS 3              // Untimed repetitions before measuring
+#define BENCH_MIN_REP_MS 2.0             // Minimum duration of one repetition
+#define MAX_BENCHMARKS 16
+#define MAX_NAME 32
+
+// Inputs shared by the kernels, generated once from the fixed seed
+typedef struct {
+  const char *words_file;
+  char **word_list;
+  int word_count;
+  unsigned long long fingerprint; // Identifies the loaded list, not its path
+  int targets[BENCH_PAIRS];
+  int guesses[BENCH_PAIRS];
+  FeedbackColor feedback[BENCH_PAIRS][WORD_LENGTH]; // For is_consistent
+  int split_guesses[BENCH_SPLIT_GUESSES];
+  bool *all_possible;  // Every word still possible (first turn)
+  bool *few_possible;  // ~2% of words possible (later turns)
+} BenchContext;
+
+// A kernel runs one batch and returns the number of operations it performed
+typedef long (*BenchFn)(BenchContext *ctx);
+
+typedef struct {
+  char name[MAX_NAME];
+  double median_ns; // Median ns per operation over the repetitions
+  double mad_ns;    // Median absolute deviation of ns per operation
+  int reps;
+} BenchResult;
+
+// Keeps the compiler from discarding kernel results
+static volatile long bench_sink;
+
+static unsigned long long rng_state = BENCH_SEED;
+
+// xorshift64*: same sequence on every platform, unlike rand()
+static unsigned long long next_random(void) {
+  rng_state ^= rng_state >> 12;
+  rng_state ^= rng_state << 25;
+  rng_state ^= rng_state >> 27;
+  return rng_state * 2685821657736338717ULL;
+}
+
+static int random_index(int n) { return (int)(next_random() % n); }
+
+static long bench_get_feedback(BenchContext *ctx) {
+  FeedbackColor feedback[WORD_LENGTH];
+  long acc = 0;
+  for (int i = 0; i < BENCH_PAIRS; i++) {
+    get_feedback(ctx->word_list[ctx->targets[i]],
+                 ctx->word_list[ctx->guesses[i]], feedback);
+    acc += feedback[i % WORD_LENGTH];
+  }
+  bench_sink += acc;
+  return BENCH_PAIRS;
+}
+
+static long bench_is_consistent(BenchContext *ctx) {
+  long acc = 0;
+  for (int i = 0; i < BENCH_PAIRS; i++) {
+    acc += is_consistent(ctx->word_list[ctx->targets[i]],
+                         ctx->word_list[ctx->guesses[i]], ctx->feedback[i]);
+  }
+  bench_sink += acc;
+  return BENCH_PAIRS;
+}
+
+static long run_splits(BenchContext *ctx, const bool *possible) {
+  long acc = 0;
+  for (int i = 0; i < BENCH_SPLIT_GUESSES; i++) {
+    acc += get_worst_case_split(ctx->word_list[ctx->split_guesses[i]],
+                                ctx->word_list, possible, ctx->word_count);
+  }
+  bench_sink += acc;
+  return BENCH_SPLIT_GUESSES;
+}
+
+static long bench_split_full(BenchContext *ctx) {
+  return run_splits(ctx, ctx->all_possible);
+}
+
+static long bench_split_sparse(BenchContext *ctx) {
+  return run_splits(ctx, ctx->few_possible);
+}
+
+static long bench_load_word_list(BenchContext *ctx) {
+  char **words;
+  int count;
+  if (!load_word_list(ctx->words_file, &words, &count))
+    return 0;
+  bench_sink += count;
+  free_word_list(words, count);
+  return 1;
+}
+
+static int compare_double(const void *a, const void *b) {
+  double x = *(const double *)a;
+  double y = *(const double *)b;
+  return (x > y) - (x < y);
+}
+
+static double median(double *values, int n) {
+  qsort(values, n, sizeof(double), compare_double);
+  return (n % 2) ? values[n / 2] : (values[n / 2 - 1] + values[n / 2]) / 2;
+}
+
+/**
+ * Times a kernel: calibrates the batches per repetition, warms up, then
+ * records ns per operation for each repetition.
+ * @return false if the kernel could not run (e.g. missing words file).
+ */
+static bool run_benchmark_kernel(const char *name, BenchFn fn,
+                                 BenchContext *ctx, int reps,
+                                 BenchResult *result) {
+  // Grow the batch count until one repetition is long enough to time
+  int batches = 1;
+  for (;;) {
+    double start = get_time_ms();
+    for (int b = 0; b < batches; b++) {
+      if (fn(ctx) == 0)
+        return false;
+    }
+    if (get_time_ms() - start >= BENCH_MIN_REP_MS || batches >= (1 << 20))
+      break;
+    batches *= 2;
+  }
+
+  for (int w = 0; w < BENCH_WARMUP_REPS; w++) {
+    for (int b = 0; b < batches; b++)
+      fn(ctx);
+  }
+
+  double *ns_per_op = malloc(reps * sizeof(double));
+  for (int r = 0; r < reps; r++) {
+    long ops = 0;
+    double start = get_time_ms();
+    for (int b = 0; b < batches; b++)
+      ops += fn(ctx);
+    ns_per_op[r] = (get_time_ms() - start) * 1e6 / ops;
+  }
+
+  snprintf(result->name, MAX_NAME, "%s", name);
+  result->reps = reps;
+  result->median_ns = median(ns_per_op, reps);
+  for (int r = 0; r < reps; r++) {
+    double d = ns_per_op[r] - result->median_ns;
+    ns_per_op[r] = d < 0 ? -d : d;
+  }
+  result->mad_ns = median(ns_per_op, reps);
+
+  free(ns_per_op);
+  return true;
+}
+
+static void init_context(BenchContext *ctx) {
+  ctx->fingerprint = word_list_fingerprint(ctx->word_list, ctx->word_count);
+  for (int i = 0; i < BENCH_PAIRS; i++) {
+    ctx->targets[i] = random_index(ctx->word_count);
+    ctx->guesses[i] = random_index(ctx->word_count);
+    // Feedback from an unrelated target, so most checks fail early like
+    // they do while filtering
+    int other = random_index(ctx->word_count);
+    get_feedback(ctx->word_list[other], ctx->word_list[ctx->guesses[i]],
+                 ctx->feedback[i]);
+  }
+  for (int i = 0; i < BENCH_SPLIT_GUESSES; i++)
+    ctx->split_guesses[i] = random_index(ctx->word_count);
+
+  ctx->all_possible = malloc(ctx->word_count * sizeof(bool));
+  ctx->few_possible = malloc(ctx->word_count * sizeof(bool));
+  for (int i = 0; i < ctx->word_count; i++) {
+    ctx->all_possible[i] = true;
+    ctx->few_possible[i] = random_index(50) == 0;
+  }
+}
+
+// Baseline format: an "input" line describing what was measured (the file name
+// is informational only), then one "name median_ns mad_ns" line per kernel.
+static bool save_results(const char *filename, const BenchContext *ctx,
+                         const BenchResult *results, int count) {
+  FILE *f = fopen(filename, "w");
+  if (!f)
+    return false;
+  fprintf(f, "input words=%d fingerprint=%016llx seed=%#llx file=%s\n",
+          ctx->word_count, ctx->fingerprint, BENCH_SEED, ctx->words_file);
+  fprintf(f, "# kernel median_ns_per_op mad_ns_per_op\n");
+  for (int i = 0; i < count; i++) {
+    fprintf(f, "%s %.4f %.4f\n", results[i].name, results[i].median_ns,
+            results[i].mad_ns);
+  }
+  fclose(f);
+  return true;
+}
+
+/**
+ * Reads a baseline saved by save_results.
+ * @return Number of kernels read, -1 if the file could not be read, or -2 if
+ * it was measured on different input (a word list with other contents, or
+ * another seed), which would make the timings not comparable.
+ */
+static int load_results(const char *filename, const BenchContext *ctx,
+                        BenchResult *results) {
+  FILE *f = fopen(filename, "r");
+  if (!f)
+    return -1;
+  int count = 0;
+  bool saw_input = false;
+  bool comparable = false;
+  char line[512];
+  while (count < MAX_BENCHMARKS && fgets(line, sizeof(line), f)) {
+    if (line[0] == '#')
+      continue;
+    int words;
+    unsigned long long fingerprint, seed;
+    if (strncmp(line, "input ", 6) == 0) {
+      saw_input = true;
+      comparable = sscanf(line, "input words=%d fingerprint=%llx seed=%llx",
+                          &words, &fingerprint, &seed) == 3 &&
+                   words == ctx->word_count &&
+                   fingerprint == ctx->fingerprint && seed == BENCH_SEED;
+      if (!comparable) {
+        fprintf(stderr,
+                "Baseline %s is not comparable: measured on %s", filename,
+                line + 6);
+        fprintf(stderr,
+                "Current input: words=%d fingerprint=%016llx seed=%#llx "
+                "file=%s\n",
+                ctx->word_count, ctx->fingerprint, BENCH_SEED,
+                ctx->words_file);
+        break;
+      }
+      continue;
+    }
+    BenchResult *r = &results[count];
+    if (sscanf(line, "%31s %lf %lf", r->name, &r->median_ns, &r->mad_ns) == 3)
+      count++;
+  }
+  fclose(f);
+  if (!saw_input)
+    fprintf(stderr, "Baseline %s has no input line; re-save it.\n", filename);
+  return comparable ? count : -2;
+}
+
+/**
+ * Compares results with a saved baseline.
+ * @return Number of kernels slower than the baseline by more than threshold
+ * percent.
+ */
+static int compare_results(const BenchResult *results, int count,
+                           const BenchResult *baseline, int baseline_count,
+                           double threshold) {
+  int regressions = 0;
+  printf("\nKernel                  | Baseline ns | Current ns |  Change | "
+         "Status\n");
+  printf("------------------------|-------------|------------|---------|---"
+         "-----\n");
+  for (int i = 0; i < count; i++) {
+    const BenchResult *base = NULL;
+    for (int j = 0; j < baseline_count; j++) {
+      if (strcmp(results[i].name, baseline[j].name) == 0)
+        base = &baseline[j];
+    }
+    if (!base) {
+      printf("%-23s | %11s | %10.2f | %7s | new\n", results[i].name, "-",
+             results[i].median_ns, "-");
+      continue;
+    }
+
+    double change = (results[i].median_ns / base->median_ns - 1.0) * 100.0;
+    const char *status = "ok";
+    if (change > threshold) {
+      status = "SLOWER";
+      regressions++;
+    } else if (change < -threshold) {
+      status = "faster";
+    }
+    printf("%-23s | %11.2f | %10.2f | %+6.1f%% | %s\n", results[i].name,
+           base->median_ns, results[i].median_ns, change, status);
+  }
+  return regressions;
+}
+
+int main(int argc, char **argv) {
+  BenchContext ctx = {.words_file = "words.txt"};
+  const char *save_file = NULL;
+  const char *compare_file = NULL;
+  double threshold = 10.0;
+  int reps = 25;
+
+  for (int i = 1; i < argc; i++) {
+    bool has_value = i + 1 < argc;
+    if (strcmp(argv[i], "--words") == 0 && has_value)
+      ctx.words_file = argv[++i];
+    else if (strcmp(argv[i], "--reps") == 0 && has_value)
+      reps = atoi(argv[++i]);
+    else if (strcmp(argv[i], "--save") == 0 && has_value)
+      save_file = argv[++i];
+    else if (strcmp(argv[i], "--compare") == 0 && has_value)
+      compare_file = argv[++i];
+    else if (strcmp(argv[i], "--threshold") == 0 && has_value)
+      threshold = atof(argv[++i]);
+    else {
+      fprintf(stderr,
+              "Usage: %s [--words FILE] [--reps N] [--save FILE] "
+              "[--compare FILE] [--threshold PCT]\n",
+              argv[0]);
+      return 2;
+    }
+  }
+  if (reps < 1)
+    reps = 1;
+
+  if (!load_word_list(ctx.words_file, &ctx.word_list, &ctx.word_count) ||
+      ctx.word_count == 0) {
+    fprintf(stderr, "Failed to load %s\n", ctx.words_file);
+    return 2;
+  }
+  init_context(&ctx);
+
+  const struct {
+    const char *name;
+    BenchFn fn;
+  } kernels[] = {
+      {"get_feedback", bench_get_feedback},
+      {"is_consistent", bench_is_consistent},
+      {"worst_case_split_full", bench_split_full},
+      {"worst_case_split_sparse", bench_split_sparse},
+      {"load_word_list", bench_load_word_list},
+  };
+  const int num_kernels = sizeof(kernels) / sizeof(kernels[0]);
+
+  printf("Words: %d (%s), repetitions: %d, seed: %#llx\n\n", ctx.word_count,
+         ctx.words_file, reps, BENCH_SEED);
+  printf("Kernel                  |  Median ns/op |     MAD ns |  MAD %%\n");
+  printf("------------------------|---------------|------------|-------\n");
+
+  BenchResult results[MAX_BENCHMARKS];
+  int count = 0;
+  for (int k = 0; k < num_kernels; k++) {
+    if (!run_benchmark_kernel(kernels[k].name, kernels[k].fn, &ctx, reps,
+                              &results[count])) {
+      fprintf(stderr, "%s: kernel failed, skipped\n", kernels[k].name);
+      continue;
+    }
+    const BenchResult *r = &results[count++];
+    printf("%-23s | %13.2f | %10.2f | %5.1f%%\n", r->name, r->median_ns,
+           r->mad_ns, r->median_ns > 0 ? r->mad_ns / r->median_ns * 100 : 0);
+  }
+
+  int status = 0;
+  if (save_file) {
+    if (save_results(save_file, &ctx, results, count))
+      printf("\nBaseline saved to %s\n", save_file);
+    else
+      fprintf(stderr, "Failed to write %s\n", save_file);
+  }
+  if (compare_file) {
+    BenchResult baseline[MAX_BENCHMARKS];
+    int baseline_count = load_results(compare_file, &ctx, baseline);
+    if (baseline_count == -1) {
+      fprintf(stderr, "Failed to read baseline %s\n", compare_file);
+      status = 2;
+    } else if (baseline_count == -2) {
+      printf("\nNot comparable with %s: input differs, no comparison made.\n",
+             compare_file);
+      status = 2;
+    } else {
+      int regressions =
+          compare_results(results, count, baseline, baseline_count, threshold);
+      printf("\n%d kernel(s) slower than baseline by more than %.1f%%\n",
+             regressions, threshold);
+      if (regressions > 0)
+        status = 1;
+    }
+  }
+
+  free(ctx.all_possible);
+  free(ctx.few_possible);
+  free_word_list(ctx.word_list, ctx.word_count);
+  return status;
+}
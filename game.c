@@ -25,6 +25,8 @@ void get_feedback(const char *target, const char *guess,
   int guess_counts[26] = {0}; // Note: guess_counts is not strictly used but
                               // good for symmetry if needed later
 
+  PROFILE_COUNT(feedback_calls);
+
   // Initialize feedback to GRAY (not in word)
   for (int i = 0; i < WORD_LENGTH; i++) {
     feedback[i] = COLOR_GRAY;
@@ -17,6 +17,8 @@
 #define ANSI_BG_YELLOW "\x1b[43m"
 #define ANSI_BG_GRAY "\x1b[100m"
 
+#define BENCHMARK_JSON_FILE "benchmark_report.json" // Machine-readable report
+
 /**
  * Prints the feedback for a guess using colored backgrounds.
  * Green: Correct letter in correct position.
@@ -99,6 +101,14 @@ void run_solver_mode(char **word_list, int word_count) {
   if (strcmp(input, "RANDOM") == 0) {
     target = get_random_word(word_list, word_count);
   } else {
+    // Feedback indexes letter counts by 'A'..'Z', so reject anything else
+    bool letters_only = strlen(input) == WORD_LENGTH;
+    for (int i = 0; letters_only && input[i]; i++)
+      letters_only = input[i] >= 'A' && input[i] <= 'Z';
+    if (!letters_only) {
+      printf("Target must be %d letters A-Z.\n", WORD_LENGTH);
+      return;
+    }
     if (!is_valid_word(input, word_list, word_count)) {
       printf("Invalid word not in dictionary. Proceeding anyway, but solver "
              "might fail if logic depends on dictionary.\n");
@@ -122,6 +132,131 @@ void run_solver_mode(char **word_list, int word_count) {
   }
 }
 
+// Results of one solver over the benchmark words
+typedef struct {
+  const char *name;
+  long long guesses;
+  int fails;
+  int dist[MAX_GUESSES + 2]; // Index 1-6, 7 for fail
+  double *latency_ms;        // Per-game wall time
+  double total_ms;
+  ProfileCounters counters; // Summed over all games
+} SolverStats;
+
+typedef int (*SolverFn)(const char *target, char **word_list, int word_count,
+                        bool silent);
+
+static int compare_double(const void *a, const void *b) {
+  double x = *(const double *)a;
+  double y = *(const double *)b;
+  return (x > y) - (x < y);
+}
+
+// Nearest-rank percentile of an ascending array.
+static double percentile(const double *sorted, int n, double p) {
+  if (n == 0)
+    return 0;
+  int rank = (int)(p / 100.0 * n + 0.999999);
+  if (rank < 1)
+    rank = 1;
+  return sorted[(rank > n ? n : rank) - 1];
+}
+
+/**
+ * Plays every test word with one solver, timing each game.
+ */
+static void run_solver_suite(SolverFn solve, char **test_words, int num_tests,
+                             char **word_list, int word_count,
+                             SolverStats *stats) {
+  stats->latency_ms = malloc(num_tests * sizeof(double));
+  profile_reset();
+
+  printf("\nRunning %s Solver...\n[", stats->name);
+  double suite_start = get_time_ms();
+  for (int i = 0; i < num_tests; i++) {
+    if (i % (num_tests / 10 + 1) == 0)
+      printf("#");
+    fflush(stdout);
+    double start = get_time_ms();
+    int g = solve(test_words[i], word_list, word_count, true);
+    stats->latency_ms[i] = get_time_ms() - start;
+    if (g > MAX_GUESSES) {
+      stats->fails++;
+      stats->dist[MAX_GUESSES + 1]++;
+    } else {
+      stats->guesses += g;
+      stats->dist[g]++;
+    }
+  }
+  stats->total_ms = get_time_ms() - suite_start;
+  printf("] Done.\n");
+
+  profile_get(&stats->counters);
+  qsort(stats->latency_ms, num_tests, sizeof(double), compare_double);
+}
+
+static double average_guesses(const SolverStats *stats, int num_tests) {
+  return (stats->fails == num_tests)
+             ? 0
+             : (double)stats->guesses / (num_tests - stats->fails);
+}
+
+/**
+ * Writes the benchmark results as JSON for dashboards.
+ */
+static bool write_benchmark_json(const char *filename, const SolverStats *stats,
+                                 int num_solvers, int num_tests) {
+  FILE *f = fopen(filename, "w");
+  if (!f)
+    return false;
+
+  fprintf(f, "{\n  \"words_tested\": %d,\n  \"profiling\": %s,\n", num_tests,
+          PROFILE_ENABLED ? "true" : "false");
+  fprintf(f, "  \"solvers\": [\n");
+  for (int s = 0; s < num_solvers; s++) {
+    const SolverStats *st = &stats[s];
+    fprintf(f, "    {\n      \"name\": \"%s\",\n", st->name);
+    fprintf(f, "      \"avg_guesses\": %.4f,\n", average_guesses(st, num_tests));
+    fprintf(f, "      \"failures\": %d,\n      \"distribution\": [", st->fails);
+    for (int i = 1; i <= MAX_GUESSES + 1; i++)
+      fprintf(f, "%s%d", i > 1 ? ", " : "", st->dist[i]);
+    fprintf(f, "],\n");
+    fprintf(f, "      \"games_per_sec\": %.3f,\n",
+            st->total_ms > 0 ? num_tests * 1000.0 / st->total_ms : 0);
+    fprintf(f,
+            "      \"latency_ms\": {\"mean\": %.4f, \"p50\": %.4f, "
+            "\"p95\": %.4f, \"p99\": %.4f, \"max\": %.4f},\n",
+            st->total_ms / num_tests, percentile(st->latency_ms, num_tests, 50),
+            percentile(st->latency_ms, num_tests, 95),
+            percentile(st->latency_ms, num_tests, 99),
+            st->latency_ms[num_tests - 1]);
+
+    if (PROFILE_ENABLED) {
+      const ProfileCounters *c = &st->counters;
+      fprintf(f,
+              "      \"per_game\": {\"get_feedback\": %.1f, "
+              "\"is_consistent\": %.1f, \"allocations\": %.2f},\n",
+              (double)c->feedback_calls / num_tests,
+              (double)c->consistency_calls / num_tests,
+              (double)c->allocations / num_tests);
+      fprintf(f, "      \"turns_ms_per_game\": [");
+      for (int t = 0; t < MAX_GUESSES; t++) {
+        fprintf(f, "%s{\"turn\": %d, \"filter\": %.4f, \"scoring\": %.4f}",
+                t > 0 ? ", " : "", t + 1, c->filter_ms[t] / num_tests,
+                c->scoring_ms[t] / num_tests);
+      }
+      fprintf(f, "]\n");
+    } else {
+      fprintf(f, "      \"per_game\": null,\n      \"turns_ms_per_game\": null\n");
+    }
+    fprintf(f, "    }%s\n", s + 1 < num_solvers ? "," : "");
+  }
+  fprintf(f, "  ]\n}\n");
+
+  fclose(f);
+  return true;
+}
+
 /**
  * Runs the benchmark mode to compare solvers.
  */
@@ -150,91 +285,175 @@ void run_benchmark(char **word_list, int word_count) {
   }
 
   // Stats
-  long long simple_guesses = 0;
-  int simple_fails = 0;
-  int simple_dist[MAX_GUESSES + 2] = {0}; // Index 1-6, 7 for fail
+  SolverStats stats[2] = {{.name = "Simple"}, {.name = "Minimax"}};
+  SolverFn solvers[2] = {solve_game_simple, solve_game_minimax};
+  for (int s = 0; s < 2; s++)
+    run_solver_suite(solvers[s], test_words, num_tests, word_list, word_count,
+                     &stats[s]);
 
-  long long minimax_guesses = 0;
-  int minimax_fails = 0;
-  int minimax_dist[MAX_GUESSES + 2] = {0};
+  // Report
+  printf("\n--- Benchmark Report ---\n");
+  printf("Words Tested: %d\n\n", num_tests);
 
-  printf("\nRunning Simple Solver...\n[");
-  for (int i = 0; i < num_tests; i++) {
-    if (i % (num_tests / 10 + 1) == 0)
-      printf("#");
-    fflush(stdout);
-    int g = solve_game_simple(test_words[i], word_list, word_count, true);
-    if (g > MAX_GUESSES) {
-      simple_fails++;
-      simple_dist[MAX_GUESSES + 1]++;
-    } else {
-      simple_guesses += g;
-      simple_dist[g]++;
-    }
+  printf("Strategy | Avg Guesses | Failures | Distribution (1..6+)\n");
+  printf("---------|-------------|----------|----------------------\n");
+  for (int s = 0; s < 2; s++) {
+    printf("%-8s | %11.2f | %8d | ", stats[s].name,
+           average_guesses(&stats[s], num_tests), stats[s].fails);
+    for (int i = 1; i <= MAX_GUESSES; i++)
+      printf("%d ", stats[s].dist[i]);
+    printf("(%d)\n", stats[s].dist[MAX_GUESSES + 1]);
   }
-  printf("] Done.\n");
 
-  printf("\nRunning Minimax Solver...\n[");
-  for (int i = 0; i < num_tests; i++) {
-    if (i % (num_tests / 10 + 1) == 0)
-      printf("#");
-    fflush(stdout);
-    int g = solve_game_minimax(test_words[i], word_list, word_count, true);
-    if (g > MAX_GUESSES) {
-      minimax_fails++;
-      minimax_dist[MAX_GUESSES + 1]++;
-    } else {
-      minimax_guesses += g;
-      minimax_dist[g]++;
+  printf("\nStrategy |  Games/s |   p50 ms |   p95 ms |   p99 ms\n");
+  printf("---------|----------|----------|----------|---------\n");
+  for (int s = 0; s < 2; s++) {
+    printf("%-8s | %8.1f | %8.3f | %8.3f | %8.3f\n", stats[s].name,
+           stats[s].total_ms > 0 ? num_tests * 1000.0 / stats[s].total_ms : 0,
+           percentile(stats[s].latency_ms, num_tests, 50),
+           percentile(stats[s].latency_ms, num_tests, 95),
+           percentile(stats[s].latency_ms, num_tests, 99));
+  }
+
+  if (PROFILE_ENABLED) {
+    printf("\nStrategy | get_feedback/game | is_consistent/game | "
+           "allocs/game\n");
+    printf("---------|-------------------|--------------------|-----------"
+           "-\n");
+    for (int s = 0; s < 2; s++) {
+      const ProfileCounters *c = &stats[s].counters;
+      printf("%-8s | %17.1f | %18.1f | %11.2f\n", stats[s].name,
+             (double)c->feedback_calls / num_tests,
+             (double)c->consistency_calls / num_tests,
+             (double)c->allocations / num_tests);
+    }
+
+    printf("\nPer-turn time (ms/game) | Simple filter | Simple score | "
+           "Minimax filter | Minimax score\n");
+    for (int t = 0; t < MAX_GUESSES; t++) {
+      printf("Turn %d                  | %13.4f | %12.4f | %14.4f | %13.4f\n",
+             t + 1, stats[0].counters.filter_ms[t] / num_tests,
+             stats[0].counters.scoring_ms[t] / num_tests,
+             stats[1].counters.filter_ms[t] / num_tests,
+             stats[1].counters.scoring_ms[t] / num_tests);
     }
+  } else {
+    printf("\n(Build with -DWORDLE_PROFILE for call counts and per-turn "
+           "timings.)\n");
   }
-  printf("] Done.\n\n");
 
-  // Report
-  printf("--- Benchmark Report ---\n");
-  printf("Words Tested: %d\n\n", num_tests);
+  if (write_benchmark_json(BENCHMARK_JSON_FILE, stats, 2, num_tests))
+    printf("\nJSON report written to %s\n", BENCHMARK_JSON_FILE);
 
-  printf("Strategy | Avg Guesses | Failures | Distribution (1..6+)\n");
-  printf("---------|-------------|----------|----------------------\n");
+  for (int s = 0; s < 2; s++)
+    free(stats[s].latency_ms);
+  free(test_words);
+}
+
+/**
+ * Runs the Minimax solver under decreasing per-turn time budgets and reports
+ * how much solution quality is lost compared to the exhaustive search. Always
+ * uses the built-in opener, so results don't depend on openers.txt.
+ */
+void run_deadline_benchmark(char **word_list, int word_count) {
+  // Per-turn scoring budgets in milliseconds; 0 means no deadline.
+  const double budgets[] = {0, 20, 5, 2, 1, 0.5};
+  const int num_budgets = sizeof(budgets) / sizeof(budgets[0]);
+  const int num_tests = 100;
+
+  printf("Starting Deadline Benchmark...\n");
+  printf("Selecting %d random words...\n", num_tests);
+  char **test_words = malloc(num_tests * sizeof(char *));
+  for (int i = 0; i < num_tests; i++)
+    test_words[i] = get_random_word(word_list, word_count);
+
+  // Loss compares averages over all games with a failure counted as
+  // MAX_GUESSES + 1, so turning wins into failures always shows up
+  double exhaustive_penalized = 0;
+
+  printf("\n--- Deadline Report (Minimax) ---\n");
+  printf("Words Tested: %d (Loss counts a failure as %d guesses)\n",
+         num_tests, MAX_GUESSES + 1);
+  // The book would replace turn 2 scoring, which is what this measures
+  printf("Opening: built-in (opening book not used, so turn 2 is scored)\n\n");
+  printf("Budget/turn | Avg Guesses | Failures | Cut Short | Avg ms/game | "
+         "Worst turn ms | Loss\n");
+  printf("------------|-------------|----------|-----------|-------------|-"
+         "--------------|------\n");
+
+  for (int b = 0; b < num_budgets; b++) {
+    long long total_guesses = 0;
+    int fails = 0;
+    int cut_short = 0;
+    double worst_turn_ms = 0; // Longest single guess selection
+    double start = get_time_ms();
 
-  double simple_avg = (simple_fails == num_tests)
-                          ? 0
-                          : (double)simple_guesses / (num_tests - simple_fails);
-  printf("Simple   | %11.2f | %8d | ", simple_avg, simple_fails);
-  for (int i = 1; i <= MAX_GUESSES; i++)
-    printf("%d ", simple_dist[i]);
-  printf("(%d)\n", simple_dist[MAX_GUESSES + 1]);
-
-  double minimax_avg =
-      (minimax_fails == num_tests)
-          ? 0
-          : (double)minimax_guesses / (num_tests - minimax_fails);
-  printf("Minimax  | %11.2f | %8d | ", minimax_avg, minimax_fails);
-  for (int i = 1; i <= MAX_GUESSES; i++)
-    printf("%d ", minimax_dist[i]);
-  printf("(%d)\n", minimax_dist[MAX_GUESSES + 1]);
-
-  if (choice != 2)
-    free(test_words);
+    for (int i = 0; i < num_tests; i++) {
+      bool completed = true;
+      double turn_ms = 0;
+      int g = solve_game_with_opening(STRATEGY_MINIMAX, test_words[i],
+                                      word_list, word_count, NULL, budgets[b],
+                                      &completed, &turn_ms);
+      if (!completed)
+        cut_short++;
+      if (turn_ms > worst_turn_ms)
+        worst_turn_ms = turn_ms;
+      if (g > MAX_GUESSES) {
+        fails++;
+      } else {
+        total_guesses += g;
+      }
+    }
+
+    double elapsed = get_time_ms() - start;
+    double avg = (fails == num_tests)
+                     ? 0
+                     : (double)total_guesses / (num_tests - fails);
+    double penalized =
+        (double)(total_guesses + (long long)fails * (MAX_GUESSES + 1)) /
+        num_tests;
+
+    if (budgets[b] <= 0) {
+      exhaustive_penalized = penalized;
+      printf("  unlimited");
+    } else {
+      printf("%8.1f ms", budgets[b]);
+    }
+    printf(" | %11.2f | %8d | %9d | %11.2f | %13.3f | %+5.2f\n", avg, fails,
+           cut_short, elapsed / num_tests, worst_turn_ms,
+           penalized - exhaustive_penalized);
+  }
+
+  free(test_words);
 }
 
-int main() {
+int main(int argc, char **argv) {
   srand(time(NULL)); // Seed the random number generator
 
   char **word_list;
   int word_count;
 
-  // Load the dictionary
-  if (!load_word_list("words.txt", &word_list, &word_count)) {
-    fprintf(stderr, "Failed to load words.txt\n");
+  // Load the dictionary: words.txt, or every list given on the command line
+  const char *default_files[] = {"words.txt"};
+  const char **files = (argc > 1) ? (const char **)argv + 1 : default_files;
+  int file_count = (argc > 1) ? argc - 1 : 1;
+  if (!load_word_lists(files, file_count, &word_list, NULL, &word_count) ||
+      word_count == 0) {
+    fprintf(stderr, "Failed to load word list\n");
     return 1;
   }
   printf("Loaded %d words.\n", word_count);
 
+  // Use the analysed openers if a book for this dictionary exists
+  if (load_opening_book(OPENING_BOOK_FILE, word_list, word_count))
+    printf("Loaded opening book from %s.\n", OPENING_BOOK_FILE);
+
   // Menu
   printf("1. Play Manual\n");
   printf("2. Run Solver\n");
   printf("3. Benchmark Solvers\n");
+  printf("4. Benchmark Minimax Deadlines\n");
+  printf("5. Analyze Openers (writes %s)\n", OPENING_BOOK_FILE);
   printf("Choice: ");
   int choice;
   if (scanf("%d", &choice) != 1)
@@ -246,6 +465,11 @@ int main() {
     run_solver_mode(word_list, word_count);
   } else if (choice == 3) {
     run_benchmark(word_list, word_count);
+  } else if (choice == 4) {
+    run_deadline_benchmark(word_list, word_count);
+  } else if (choice == 5) {
+    // The solvers pick up the new book the next time the program starts
+    run_opener_analysis(word_list, word_count, OPENING_BOOK_FILE);
   } else {
     printf("Invalid choice.\n");
   }
@@ -7,6 +7,7 @@
 // Checks if a candidate word is consistent with the feedback received
 bool is_consistent(const char *candidate, const char *guess,
                    const FeedbackColor *feedback) {
+  PROFILE_COUNT(consistency_calls);
   FeedbackColor simulated_feedback[WORD_LENGTH];
   get_feedback(candidate, guess, simulated_feedback);
 
@@ -18,11 +19,52 @@ bool is_consistent(const char *candidate, const char *guess,
   return true;
 }
 
+// Opening plans used by solve_game_simple / solve_game_minimax. Empty until
+// set_solver_opening installs one (e.g. from the opening book).
+static Opening solver_openings[STRATEGY_COUNT];
+
+/**
+ * Installs the opening plan a strategy uses for its first two guesses.
+ * @param strategy The strategy to configure.
+ * @param opening The opening to copy, or NULL to restore the built-in opener.
+ */
+void set_solver_opening(SolverStrategy strategy, const Opening *opening) {
+  if (opening)
+    solver_openings[strategy] = *opening;
+  else
+    memset(&solver_openings[strategy], 0, sizeof(Opening));
+}
+
+// Writes the first guess: the opening's opener if one is loaded, otherwise the
+// fallback word, otherwise the first dictionary word.
+static void get_first_guess(const Opening *opening, const char *fallback,
+                            char **word_list, int word_count, char *out) {
+  if (opening && opening->loaded) {
+    strcpy(out, opening->opener);
+  } else {
+    strcpy(out, fallback);
+    if (!is_valid_word(out, word_list, word_count))
+      strcpy(out, word_list[0]);
+  }
+}
+
+// Looks up the planned second guess after the opener returned this feedback.
+// Returns NULL when there is no plan (no opening, or a different first guess).
+static const char *get_opening_reply(const Opening *opening,
+                                     const char *first_guess,
+                                     const FeedbackColor *feedback) {
+  if (!opening || !opening->loaded || strcmp(first_guess, opening->opener) != 0)
+    return NULL;
+  const char *reply = opening->replies[get_feedback_index(feedback)];
+  return reply[0] ? reply : NULL;
+}
+
 // Simple solver: Filters words based on consistency and picks the first
 // available one.
-int solve_game_simple(const char *target, char **word_list, int word_count,
-                      bool silent) {
+static int simple_game(const char *target, char **word_list, int word_count,
+                       bool silent, const Opening *opening) {
   bool *possible = malloc(word_count * sizeof(bool));
+  PROFILE_COUNT(allocations);
   for (int i = 0; i < word_count; i++)
     possible[i] = true;
 
@@ -30,11 +72,8 @@ int solve_game_simple(const char *target, char **word_list, int word_count,
   int guesses = 0;
   char current_guess[WORD_LENGTH + 1];
 
-  // Start with "CRANE" or first word
-  strcpy(current_guess, "CRANE");
-  if (!is_valid_word(current_guess, word_list, word_count)) {
-    strcpy(current_guess, word_list[0]);
-  }
+  // Start with the opening's opener, "CRANE" or first word
+  get_first_guess(opening, "CRANE", word_list, word_count, current_guess);
 
   if (!silent) {
     printf("Target: %s\n", target);
@@ -69,6 +108,7 @@ int solve_game_simple(const char *target, char **word_list, int word_count,
     }
 
     // Filter impossible words
+    PROFILE_SPAN_BEGIN(filter_span);
     int new_count = 0;
     for (int i = 0; i < word_count; i++) {
       if (possible[i]) {
@@ -80,6 +120,7 @@ int solve_game_simple(const char *target, char **word_list, int word_count,
       }
     }
     possible_count = new_count;
+    PROFILE_SPAN_END(filter_span, filter_ms, guesses);
     if (!silent)
       printf("Remaining possibilities: %d\n", possible_count);
 
@@ -89,20 +130,35 @@ int solve_game_simple(const char *target, char **word_list, int word_count,
       break;
     }
 
-    // Pick next valid word
-    for (int i = 0; i < word_count; i++) {
-      if (possible[i]) {
-        strcpy(current_guess, word_list[i]);
-        break;
+    // Pick next valid word, or the planned consistent reply after the opener
+    PROFILE_SPAN_BEGIN(scoring_span);
+    const char *reply = (guesses == 0)
+                            ? get_opening_reply(opening, current_guess, feedback)
+                            : NULL;
+    if (reply) {
+      strcpy(current_guess, reply);
+    } else {
+      for (int i = 0; i < word_count; i++) {
+        if (possible[i]) {
+          strcpy(current_guess, word_list[i]);
+          break;
+        }
       }
     }
+    PROFILE_SPAN_END(scoring_span, scoring_ms, guesses);
     guesses++;
   }
 
   if (!silent)
     printf("Solver failed to find the word within %d guesses.\n", MAX_GUESSES);
   free(possible);
-  return guesses;
+  return MAX_GUESSES + 1;
+}
+
+int solve_game_simple(const char *target, char **word_list, int word_count,
+                      bool silent) {
+  return simple_game(target, word_list, word_count, silent,
+                     &solver_openings[STRATEGY_SIMPLE]);
 }
 
 // --- Minimax Solver Helpers ---
@@ -143,9 +199,144 @@ int get_worst_case_split(const char *guess, char **word_list,
   return max_count;
 }
 
-int solve_game_minimax(const char *target, char **word_list, int word_count,
-                       bool silent) {
+// Orders candidates for anytime scoring: returns true if word a should be
+// kept over word b when both have the same worst case. Possible answers win,
+// then the lower dictionary index, so a completed search picks the same guess
+// regardless of the order in which words were scored.
+static bool prefer_on_tie(int a, int b, const bool *possible) {
+  if (possible[a] != possible[b])
+    return possible[a];
+  return a < b;
+}
+
+typedef struct {
+  int index;
+  int coverage;
+} ScoredWord;
+
+static int compare_coverage_desc(const void *a, const void *b) {
+  const ScoredWord *x = a;
+  const ScoredWord *y = b;
+  if (x->coverage != y->coverage)
+    return y->coverage - x->coverage;
+  return x->index - y->index;
+}
+
+// Fills order[start..] with the words that are not possible answers, sorted
+// by how many possible answers share their (distinct) letters.
+static void order_by_coverage(char **word_list, const bool *possible,
+                              int word_count, ScoredWord *order, int start) {
+  int letter_counts[26] = {0};
+  for (int i = 0; i < word_count; i++) {
+    if (!possible[i])
+      continue;
+    bool seen[26] = {false};
+    for (int j = 0; j < WORD_LENGTH; j++) {
+      int c = word_list[i][j] - 'A';
+      if (!seen[c]) {
+        seen[c] = true;
+        letter_counts[c]++;
+      }
+    }
+  }
+
+  int n = start;
+  for (int i = 0; i < word_count; i++) {
+    if (possible[i])
+      continue;
+    bool seen[26] = {false};
+    int coverage = 0;
+    for (int j = 0; j < WORD_LENGTH; j++) {
+      int c = word_list[i][j] - 'A';
+      if (!seen[c]) {
+        seen[c] = true;
+        coverage += letter_counts[c];
+      }
+    }
+    order[n].index = i;
+    order[n].coverage = coverage;
+    n++;
+  }
+  qsort(order + start, n - start, sizeof(ScoredWord), compare_coverage_desc);
+}
+
+/**
+ * Picks the guess with the smallest worst-case split, scoring the most
+ * promising words first so it can stop early when a deadline is hit.
+ * Possible answers are scored first, then the remaining words ordered by how
+ * many possible answers share their (distinct) letters. The clock is read
+ * before every candidate, so the deadline is overshot by at most one pass.
+ * @param word_list The dictionary.
+ * @param possible Flags marking words still consistent with the feedback.
+ * @param word_count The number of words in the dictionary.
+ * @param deadline_ms Absolute get_time_ms() deadline, or <= 0 for no limit.
+ * @param completed Set to true if every word was scored, false if the deadline
+ * cut the search short (may be NULL).
+ * @return Index of the best guess found so far, or -1 if the list is empty.
+ */
+int select_guess_anytime(char **word_list, const bool *possible,
+                         int word_count, double deadline_ms, bool *completed) {
+  ScoredWord *order = malloc(word_count * sizeof(ScoredWord));
+  PROFILE_COUNT(allocations);
+  int possible_total = 0;
+  for (int i = 0; i < word_count; i++) {
+    if (possible[i])
+      order[possible_total++].index = i;
+  }
+
+  int min_worst_case = word_count + 1;
+  int best_word_index = -1;
+  bool done = true;
+
+  for (int k = 0; k < word_count; k++) {
+    // Only order the other words once every possible answer has been scored;
+    // with a tight deadline the search usually never gets this far.
+    if (k == possible_total)
+      order_by_coverage(word_list, possible, word_count, order, possible_total);
+
+    // One clock read is cheap next to one candidate pass, so check before
+    // every candidate to keep the overshoot below one pass.
+    if (deadline_ms > 0 && get_time_ms() >= deadline_ms) {
+      done = false;
+      if (best_word_index == -1)
+        best_word_index = order[0].index;
+      break;
+    }
+
+    int i = order[k].index;
+    int worst_case =
+        get_worst_case_split(word_list[i], word_list, possible, word_count);
+
+    if (worst_case < min_worst_case ||
+        (worst_case == min_worst_case &&
+         prefer_on_tie(i, best_word_index, possible))) {
+      min_worst_case = worst_case;
+      best_word_index = i;
+    }
+
+    // A possible answer that splits everything into singletons can't be
+    // beaten.
+    if (min_worst_case == 1 && possible[best_word_index])
+      break;
+  }
+
+  free(order);
+  if (completed)
+    *completed = done;
+  return best_word_index;
+}
+
+// Minimax game loop shared by the public entry points.
+static int minimax_game(const char *target, char **word_list, int word_count,
+                        bool silent, const Opening *opening, double budget_ms,
+                        bool *completed, double *max_turn_ms) {
+  if (completed)
+    *completed = true;
+  if (max_turn_ms)
+    *max_turn_ms = 0;
+
   bool *possible = malloc(word_count * sizeof(bool));
+  PROFILE_COUNT(allocations);
   for (int i = 0; i < word_count; i++)
     possible[i] = true;
 
@@ -153,11 +344,8 @@ int solve_game_minimax(const char *target, char **word_list, int word_count,
   int guesses = 0;
   char current_guess[WORD_LENGTH + 1];
 
-  // Hardcoded best opener
-  strcpy(current_guess, "RAISE");
-  if (!is_valid_word(current_guess, word_list, word_count)) {
-    strcpy(current_guess, word_list[0]);
-  }
+  // Opening book opener, or the hardcoded best opener
+  get_first_guess(opening, "RAISE", word_list, word_count, current_guess);
 
   if (!silent) {
     printf("Target: %s\n", target);
@@ -192,6 +380,7 @@ int solve_game_minimax(const char *target, char **word_list, int word_count,
     }
 
     // Filter possibilities
+    PROFILE_SPAN_BEGIN(filter_span);
     int new_count = 0;
     for (int i = 0; i < word_count; i++) {
       if (possible[i]) {
@@ -203,6 +392,7 @@ int solve_game_minimax(const char *target, char **word_list, int word_count,
       }
     }
     possible_count = new_count;
+    PROFILE_SPAN_END(filter_span, filter_ms, guesses);
     if (!silent)
       printf("Remaining possibilities: %d\n", possible_count);
 
@@ -223,33 +413,28 @@ int solve_game_minimax(const char *target, char **word_list, int word_count,
       continue;
     }
 
-    // Minimax: Minimize worst-case split size
-    // Tie-breaker: Prefer words that are possible answers
-    int min_worst_case = word_count + 1;
-    int best_word_index = -1;
-
-    for (int i = 0; i < word_count; i++) {
-      int worst_case =
-          get_worst_case_split(word_list[i], word_list, possible, word_count);
-
-      if (worst_case < min_worst_case) {
-        min_worst_case = worst_case;
-        best_word_index = i;
-      } else if (worst_case == min_worst_case) {
-        // Refinement: If worst cases are equal, prefer a word that is a
-        // possible answer! This is a crucial heuristic. If I guess a word that
-        // *can't* be the answer, I get info but 0% chance of winning now. If I
-        // guess a word that *can* be the answer, I get info AND chance to win.
-        if (best_word_index != -1 && !possible[best_word_index] &&
-            possible[i]) {
-          best_word_index = i;
-        }
-      }
-
-      if (min_worst_case == 1 && possible[best_word_index])
-        break;
+    // The opening book already scored the reply to every first-turn pattern
+    const char *reply = (guesses == 0)
+                            ? get_opening_reply(opening, current_guess, feedback)
+                            : NULL;
+    if (reply) {
+      strcpy(current_guess, reply);
+      guesses++;
+      continue;
     }
 
+    PROFILE_SPAN_BEGIN(scoring_span);
+    bool turn_completed = true;
+    double turn_start = get_time_ms();
+    double deadline_ms = (budget_ms > 0) ? turn_start + budget_ms : 0;
+    int best_word_index = select_guess_anytime(word_list, possible, word_count,
+                                               deadline_ms, &turn_completed);
+    if (!turn_completed && completed)
+      *completed = false;
+    double turn_ms = get_time_ms() - turn_start;
+    if (max_turn_ms && turn_ms > *max_turn_ms)
+      *max_turn_ms = turn_ms;
+
     if (best_word_index != -1) {
       strcpy(current_guess, word_list[best_word_index]);
     } else {
@@ -260,6 +445,7 @@ int solve_game_minimax(const char *target, char **word_list, int word_count,
         }
       }
     }
+    PROFILE_SPAN_END(scoring_span, scoring_ms, guesses);
 
     guesses++;
   }
@@ -267,5 +453,50 @@ int solve_game_minimax(const char *target, char **word_list, int word_count,
   if (!silent)
     printf("Solver failed to find the word within %d guesses.\n", MAX_GUESSES);
   free(possible);
-  return guesses;
+  return MAX_GUESSES + 1;
+}
+
+/**
+ * Runs the minimax solver with a per-turn time budget for guess selection.
+ * @param budget_ms Milliseconds allowed for scoring each turn, or <= 0 for an
+ * exhaustive search.
+ * @param completed Set to false if any turn ran out of time (may be NULL).
+ * @param max_turn_ms Receives the longest guess selection of the game, in
+ * milliseconds (may be NULL).
+ * @return Number of guesses used, or MAX_GUESSES + 1 if the solver failed.
+ */
+int solve_game_minimax_budget(const char *target, char **word_list,
+                              int word_count, bool silent, double budget_ms,
+                              bool *completed, double *max_turn_ms) {
+  return minimax_game(target, word_list, word_count, silent,
+                      &solver_openings[STRATEGY_MINIMAX], budget_ms, completed,
+                      max_turn_ms);
+}
+
+/**
+ * Plays one silent game with an explicit opening instead of the installed one.
+ * Used by the opener analysis to evaluate candidate openings, and by the
+ * deadline benchmark to measure turn 2 without the opening book.
+ * @param opening The opening to use, or NULL for the built-in opener.
+ * @param budget_ms Minimax only: per-turn budget, or <= 0 for no limit.
+ * @param completed Minimax only: set to false if any turn ran out of time
+ * (may be NULL).
+ * @param max_turn_ms Minimax only: receives the longest guess selection
+ * (may be NULL).
+ * @return Number of guesses used, or MAX_GUESSES + 1 if the solver failed.
+ */
+int solve_game_with_opening(SolverStrategy strategy, const char *target,
+                            char **word_list, int word_count,
+                            const Opening *opening, double budget_ms,
+                            bool *completed, double *max_turn_ms) {
+  if (strategy == STRATEGY_SIMPLE)
+    return simple_game(target, word_list, word_count, true, opening);
+  return minimax_game(target, word_list, word_count, true, opening, budget_ms,
+                      completed, max_turn_ms);
+}
+
+int solve_game_minimax(const char *target, char **word_list, int word_count,
+                       bool silent) {
+  return minimax_game(target, word_list, word_count, silent,
+                      &solver_openings[STRATEGY_MINIMAX], 0, NULL, NULL);
 }
@@ -1,8 +1,29 @@
+// clock_gettime, mmap and friends are POSIX, not ISO C; declare them under
+// strict -std=c11 builds too
+#define _POSIX_C_SOURCE 200809L
+
 #include "wordle.h"
 #include <ctype.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <time.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#define LOADER_CHUNKS_PER_THREAD 4 // Parse chunks per thread, for balance
+#define LOADER_BATCH 1024          // Entries parsed before hashing them
 
 /**
  * Converts a string to uppercase in place.
@@ -14,53 +35,384 @@ void to_upper_string(char *str) {
   }
 }
 
-/**
- * Loads the word list from a file.
- * @param filename The path to the file containing words.
- * @param words Pointer to the array of strings to store the words.
- * @param count Pointer to an integer to store the number of words loaded.
- * @return true if successful, false otherwise.
- */
-bool load_word_list(const char *filename, char ***words, int *count) {
-  FILE *f = fopen(filename, "r");
+// A file's contents, memory-mapped when possible
+typedef struct {
+  const char *data;
+  size_t size;
+  bool mapped;
+} FileView;
+
+// One accepted dictionary line: packed letters and optional frequency
+typedef struct {
+  unsigned long long code; // 5 bits per letter, first letter lowest
+  double weight;           // Frequency column, 0 if absent
+} WordEntry;
+
+// Deduplicating hash index over packed words, in first-seen order
+typedef struct {
+  int *slots;          // Index + 1 into entries, 0 = empty
+  int slot_count;      // Power of two
+  WordEntry *entries;  // Distinct words; weight is the largest seen
+  int count;
+  int capacity;
+} WordIndex;
+
+static bool open_file_view(const char *filename, FileView *view) {
+  view->data = NULL;
+  view->size = 0;
+  view->mapped = false;
+
+#ifndef _WIN32
+  int fd = open(filename, O_RDONLY);
+  if (fd < 0)
+    return false;
+  struct stat st;
+  if (fstat(fd, &st) == 0 && st.st_size > 0) {
+    void *data = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (data != MAP_FAILED) {
+      view->data = data;
+      view->size = st.st_size;
+      view->mapped = true;
+      close(fd);
+      return true;
+    }
+  }
+  close(fd);
+#endif
+
+  // No mmap: read the file in chunks into one growing buffer
+  FILE *f = fopen(filename, "rb");
   if (!f)
     return false;
+  size_t capacity = 1 << 16;
+  char *buffer = malloc(capacity);
+  size_t n;
+  while (buffer &&
+         (n = fread(buffer + view->size, 1, capacity - view->size, f)) > 0) {
+    view->size += n;
+    if (view->size == capacity) {
+      capacity *= 2;
+      char *grown = realloc(buffer, capacity);
+      if (!grown)
+        free(buffer);
+      buffer = grown;
+    }
+  }
+  fclose(f);
+  view->data = buffer;
+  return buffer != NULL;
+}
+
+static void close_file_view(FileView *view) {
+#ifndef _WIN32
+  if (view->mapped) {
+    munmap((void *)view->data, view->size);
+    return;
+  }
+#endif
+  free((void *)view->data);
+}
+
+static bool is_blank(char c) {
+  return c == ' ' || c == '\t' || c == '\r' || c == ',';
+}
+
+// Parses a non-negative decimal such as "42", "0.5" or "1.2e-05", advancing
+// *p past it. Returns 0 if there is no number.
+static double parse_weight(const char **p, const char *end) {
+  const char *q = *p;
+  double value = 0;
+  while (q < end && *q >= '0' && *q <= '9')
+    value = value * 10 + (*q++ - '0');
+  if (q < end && *q == '.') {
+    double scale = 0.1;
+    for (q++; q < end && *q >= '0' && *q <= '9'; q++, scale *= 0.1)
+      value += (*q - '0') * scale;
+  }
+  if (q < end && (*q == 'e' || *q == 'E')) {
+    q++;
+    bool negative = q < end && *q == '-';
+    if (q < end && (*q == '-' || *q == '+'))
+      q++;
+    int exponent = 0;
+    while (q < end && *q >= '0' && *q <= '9' && exponent < 400)
+      exponent = exponent * 10 + (*q++ - '0');
+    for (; exponent > 0; exponent--)
+      value = negative ? value / 10 : value * 10;
+  }
+  *p = q;
+  return value;
+}
+
+static bool word_index_init(WordIndex *index) {
+  index->slot_count = 1024;
+  index->slots = calloc(index->slot_count, sizeof(int));
+  index->capacity = index->slot_count / 2;
+  index->entries = malloc(index->capacity * sizeof(WordEntry));
+  index->count = 0;
+  return index->slots && index->entries;
+}
+
+static void word_index_free(WordIndex *index) {
+  free(index->slots);
+  free(index->entries);
+}
+
+static unsigned int hash_code(unsigned long long code, int slot_count) {
+  return (unsigned int)((code * 0x9E3779B97F4A7C15ULL) >> 32) &
+         (slot_count - 1);
+}
+
+// Doubles the table and the entry arrays, keeping the load factor <= 1/2.
+static bool word_index_grow(WordIndex *index) {
+  int slot_count = index->slot_count * 2;
+  int *slots = calloc(slot_count, sizeof(int));
+  int capacity = slot_count / 2;
+  WordEntry *entries = realloc(index->entries, capacity * sizeof(WordEntry));
+  if (entries)
+    index->entries = entries;
+  if (!slots || !entries) {
+    free(slots);
+    return false;
+  }
 
-  char buffer[100];
-  int capacity = 100;
-  *count = 0;
-  *words = malloc(capacity * sizeof(char *));
+  for (int i = 0; i < index->count; i++) {
+    unsigned int h = hash_code(index->entries[i].code, slot_count);
+    while (slots[h])
+      h = (h + 1) & (slot_count - 1);
+    slots[h] = i + 1;
+  }
+  free(index->slots);
+  index->slots = slots;
+  index->slot_count = slot_count;
+  index->capacity = capacity;
+  return true;
+}
 
-  while (fgets(buffer, sizeof(buffer), f)) {
-    buffer[strcspn(buffer, "\n")] = 0;
-    buffer[strcspn(buffer, "\r")] = 0;
+// Adds a word unless already present; duplicates keep the larger weight.
+static bool word_index_add(WordIndex *index, const WordEntry *entry) {
+  unsigned int h = hash_code(entry->code, index->slot_count);
+  while (index->slots[h]) {
+    WordEntry *existing = &index->entries[index->slots[h] - 1];
+    if (existing->code == entry->code) {
+      if (entry->weight > existing->weight)
+        existing->weight = entry->weight;
+      return true;
+    }
+    h = (h + 1) & (index->slot_count - 1);
+  }
+
+  if (index->count == index->capacity) {
+    if (!word_index_grow(index))
+      return false;
+    return word_index_add(index, entry);
+  }
 
-    if (strlen(buffer) != WORD_LENGTH)
-      continue;
+  index->entries[index->count] = *entry;
+  index->slots[h] = ++index->count;
+  return true;
+}
 
-    if (*count >= capacity) {
-      capacity *= 2;
-      *words = realloc(*words, capacity * sizeof(char *));
+/**
+ * Parses the lines in [p, end) in a single pass. A line is accepted if its
+ * first field is exactly WORD_LENGTH ASCII letters; an optional second field
+ * (after blanks or a comma) is its frequency.
+ * @param index Receives the accepted words, deduplicated as they are read.
+ * @return false if memory ran out.
+ */
+static bool parse_lines(const char *p, const char *end, WordIndex *index) {
+  // Parsing a batch before hashing it keeps several table lookups in flight
+  WordEntry batch[LOADER_BATCH];
+  int pending = 0;
+  while (p < end) {
+    while (p < end && is_blank(*p))
+      p++;
+
+    unsigned long long code = 0;
+    int length = 0;
+    bool letters_only = true;
+    for (; p < end && *p != '\n' && !is_blank(*p); p++, length++) {
+      unsigned char c = (unsigned char)*p & ~0x20; // ASCII upper case
+      if (c < 'A' || c > 'Z')
+        letters_only = false;
+      else if (length < WORD_LENGTH)
+        code |= (unsigned long long)(c - 'A') << (5 * length);
     }
 
-    (*words)[*count] = strdup(buffer);
-    to_upper_string((*words)[*count]);
-    (*count)++;
+    if (letters_only && length == WORD_LENGTH) {
+      while (p < end && is_blank(*p))
+        p++;
+      batch[pending].code = code;
+      batch[pending].weight = parse_weight(&p, end);
+      if (++pending == LOADER_BATCH) {
+        for (int i = 0; i < pending; i++)
+          if (!word_index_add(index, &batch[i]))
+            return false;
+        pending = 0;
+      }
+    }
+
+    // Skip whatever is left of the line
+    if (p < end && *p != '\n') {
+      const char *line_end = memchr(p, '\n', end - p);
+      p = line_end ? line_end : end;
+    }
+    p++;
   }
 
-  fclose(f);
+  for (int i = 0; i < pending; i++)
+    if (!word_index_add(index, &batch[i]))
+      return false;
   return true;
 }
 
+/**
+ * Parses one file in parallel chunks and merges its words into the index.
+ * @return false if the file could not be read or memory ran out.
+ */
+static bool load_into_index(const char *filename, WordIndex *index) {
+  FileView view;
+  if (!open_file_view(filename, &view))
+    return false;
+
+  // Several chunks per thread for load balance; small files use one
+  int chunks = 1;
+#ifdef _OPENMP
+  if (view.size >= (1 << 20))
+    chunks = omp_get_max_threads() * LOADER_CHUNKS_PER_THREAD;
+#endif
+
+  // Chunk boundaries, each moved forward to the start of a line
+  size_t *bounds = malloc((chunks + 1) * sizeof(size_t));
+  WordIndex *parts = calloc(chunks, sizeof(WordIndex));
+  bool *parsed = calloc(chunks, sizeof(bool));
+  if (!bounds || !parts || !parsed) {
+    free(bounds);
+    free(parts);
+    free(parsed);
+    close_file_view(&view);
+    return false;
+  }
+
+  bounds[0] = 0;
+  bounds[chunks] = view.size;
+  for (int c = 1; c < chunks; c++) {
+    size_t b = view.size / chunks * c;
+    if (b < bounds[c - 1])
+      b = bounds[c - 1];
+    while (b < view.size && view.data[b - 1] != '\n')
+      b++;
+    bounds[c] = b;
+  }
+
+  // The first chunk goes straight into the index; the others are
+  // deduplicated on their own, so the merge only sees distinct words
+OMP_PRAGMA(omp parallel for schedule(dynamic) if (chunks > 1))
+  for (int c = 0; c < chunks; c++) {
+    WordIndex *target = c == 0 ? index : &parts[c];
+    if (c == 0 || word_index_init(target))
+      parsed[c] = parse_lines(view.data + bounds[c],
+                              view.data + bounds[c + 1], target);
+  }
+
+  // Merge in file order so the first occurrence of a word sets its position
+  bool ok = true;
+  for (int c = 0; ok && c < chunks; c++) {
+    ok = parsed[c];
+    for (int i = 0; ok && c > 0 && i < parts[c].count; i++)
+      ok = word_index_add(index, &parts[c].entries[i]);
+  }
+
+  for (int c = 1; c < chunks; c++)
+    word_index_free(&parts[c]);
+  free(parts);
+  free(parsed);
+  free(bounds);
+  close_file_view(&view);
+  return ok;
+}
+
+/**
+ * Loads and merges several word lists. Files are memory-mapped and parsed in
+ * parallel. Lines whose first field is not exactly WORD_LENGTH letters are
+ * skipped, words are upper-cased, and duplicates are dropped (keeping the
+ * first position and the largest frequency).
+ * @param filenames The files to read, in order.
+ * @param file_count The number of files.
+ * @param words Receives the array of words (free with free_word_list).
+ * @param weights If not NULL, receives each word's frequency column (0 if
+ * absent); free with free().
+ * @param count Receives the number of distinct words.
+ * @return true if successful, false otherwise.
+ */
+bool load_word_lists(const char **filenames, int file_count, char ***words,
+                     double **weights, int *count) {
+  WordIndex index;
+  bool ok = word_index_init(&index);
+  for (int f = 0; ok && f < file_count; f++)
+    ok = load_into_index(filenames[f], &index);
+
+  char **list = NULL;
+  char *storage = NULL;
+  double *list_weights = NULL;
+  if (ok) {
+    list = malloc((index.count + 1) * sizeof(char *));
+    storage = malloc((size_t)index.count * (WORD_LENGTH + 1) + 1);
+    if (weights)
+      list_weights = malloc((index.count + 1) * sizeof(double));
+    ok = list && storage && (list_weights || !weights);
+  }
+  if (!ok) {
+    free(list);
+    free(storage);
+    free(list_weights);
+    word_index_free(&index);
+    return false;
+  }
+
+  // All words share one block, kept in the extra slot after the last word so
+  // callers may reorder or overwrite words[0..count-1]
+  for (int i = 0; i < index.count; i++) {
+    char *word = storage + (size_t)i * (WORD_LENGTH + 1);
+    for (int j = 0; j < WORD_LENGTH; j++)
+      word[j] = 'A' + ((index.entries[i].code >> (5 * j)) & 31);
+    word[WORD_LENGTH] = '\0';
+    list[i] = word;
+    if (weights)
+      list_weights[i] = index.entries[i].weight;
+  }
+  list[index.count] = storage;
+
+  *words = list;
+  if (weights)
+    *weights = list_weights;
+  *count = index.count;
+
+  word_index_free(&index);
+  return true;
+}
+
+/**
+ * Loads the word list from a file.
+ * @param filename The path to the file containing words.
+ * @param words Pointer to the array of strings to store the words.
+ * @param count Pointer to an integer to store the number of words loaded.
+ * @return true if successful, false otherwise.
+ */
+bool load_word_list(const char *filename, char ***words, int *count) {
+  return load_word_lists(&filename, 1, words, NULL, count);
+}
+
 /**
  * Frees the memory allocated for the word list.
  * @param words The array of strings.
  * @param count The number of words.
  */
 void free_word_list(char **words, int count) {
-  for (int i = 0; i < count; i++) {
-    free(words[i]);
-  }
+  if (!words)
+    return;
+  // The loader keeps the block holding every word in words[count]
+  free(words[count]);
   free(words);
 }
 
@@ -83,6 +435,26 @@ bool is_valid_word(const char *word, char **word_list, int word_count) {
   return false;
 }
 
+/**
+ * Computes an FNV-1a hash over the words in order, identifying the exact
+ * word list that an opening book or benchmark baseline was made from.
+ * @param word_list The list of words.
+ * @param word_count The number of words in the list.
+ * @return The 64-bit fingerprint.
+ */
+unsigned long long word_list_fingerprint(char **word_list, int word_count) {
+  unsigned long long hash = 0xcbf29ce484222325ULL;
+  for (int i = 0; i < word_count; i++) {
+    for (const char *c = word_list[i]; *c; c++) {
+      hash ^= (unsigned char)*c;
+      hash *= 0x100000001b3ULL;
+    }
+    hash ^= '\n';
+    hash *= 0x100000001b3ULL;
+  }
+  return hash;
+}
+
 /**
  * Returns a random word from the word list.
  * @param word_list The list of valid words.
@@ -94,3 +466,46 @@ char *get_random_word(char **word_list, int word_count) {
     return NULL;
   return word_list[rand() % word_count];
 }
+
+/**
+ * Returns a monotonic timestamp in milliseconds, for measuring elapsed time.
+ * @return Milliseconds since an arbitrary fixed point.
+ */
+double get_time_ms(void) {
+#ifdef _WIN32
+  LARGE_INTEGER frequency, now;
+  QueryPerformanceFrequency(&frequency);
+  QueryPerformanceCounter(&now);
+  return (double)now.QuadPart * 1000.0 / (double)frequency.QuadPart;
+#else
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1000.0 + ts.tv_nsec / 1e6;
+#endif
+}
+
+#ifdef WORDLE_PROFILE
+_Thread_local ProfileCounters profile_counters;
+#endif
+
+/**
+ * Clears the calling thread's profiling counters.
+ */
+void profile_reset(void) {
+#ifdef WORDLE_PROFILE
+  memset(&profile_counters, 0, sizeof(profile_counters));
+#endif
+}
+
+/**
+ * Copies the calling thread's profiling counters (all zero when profiling is
+ * compiled out).
+ * @param out Receives the counters.
+ */
+void profile_get(ProfileCounters *out) {
+#ifdef WORDLE_PROFILE
+  *out = profile_counters;
+#else
+  memset(out, 0, sizeof(*out));
+#endif
+}
@@ -6,6 +6,8 @@
 // Game constants
 #define WORD_LENGTH 5 // Length of the word to guess
 #define MAX_GUESSES 6 // Maximum number of attempts allowed
+#define FEEDBACK_PATTERNS 243 // 3^WORD_LENGTH possible feedback patterns
+#define OPENING_BOOK_FILE "openers.txt" // Opener analysis results
 
 // Enum for feedback colors representing the state of a letter in a guess
 typedef enum {
@@ -29,14 +31,68 @@ typedef struct {
   bool game_over; // True if the game is over (won or max guesses reached)
 } GameState;
 
+// Solver strategies
+typedef enum {
+  STRATEGY_SIMPLE = 0,  // First consistent word
+  STRATEGY_MINIMAX = 1, // Minimize the worst-case split
+  STRATEGY_COUNT
+} SolverStrategy;
+
+// Planned first two guesses for a strategy
+typedef struct {
+  char opener[WORD_LENGTH + 1]; // First guess
+  char replies[FEEDBACK_PATTERNS]
+              [WORD_LENGTH + 1]; // Second guess per feedback index ("" = none)
+  bool loaded;                   // True if this opening should be used
+} Opening;
+
+// Hot-path counters, per thread. Only updated when built with
+// -DWORDLE_PROFILE; otherwise the PROFILE_* macros compile to nothing.
+typedef struct {
+  long long feedback_calls;        // get_feedback calls
+  long long consistency_calls;     // is_consistent calls
+  long long allocations;           // Heap allocations made by the solvers
+  double filter_ms[MAX_GUESSES];   // Time filtering candidates, per turn
+  double scoring_ms[MAX_GUESSES];  // Time choosing the next guess, per turn
+} ProfileCounters;
+
+#ifdef WORDLE_PROFILE
+#define PROFILE_ENABLED true
+extern _Thread_local ProfileCounters profile_counters;
+#define PROFILE_COUNT(field) (profile_counters.field++)
+#define PROFILE_SPAN_BEGIN(span) double span = get_time_ms()
+#define PROFILE_SPAN_END(span, field, turn)                                    \
+  (profile_counters.field[turn] += get_time_ms() - (span))
+#else
+#define PROFILE_ENABLED false
+#define PROFILE_COUNT(field) ((void)0)
+#define PROFILE_SPAN_BEGIN(span) ((void)0)
+#define PROFILE_SPAN_END(span, field, turn) ((void)0)
+#endif
+
+// OpenMP directive that disappears in serial builds instead of warning
+#ifdef _OPENMP
+#define OMP_PRAGMA(directive) _Pragma(#directive)
+#else
+#define OMP_PRAGMA(directive)
+#endif
+
 // Function prototypes
 
 // Utils
 void to_upper_string(char *str);
 bool load_word_list(const char *filename, char ***words, int *count);
+bool load_word_lists(const char **filenames, int file_count, char ***words,
+                     double **weights, int *count);
+// Only for lists from load_word_list(s): the words live in one block that
+// free_word_list releases, so never free or keep individual words past it.
 void free_word_list(char **words, int count);
 bool is_valid_word(const char *word, char **word_list, int word_count);
 char *get_random_word(char **word_list, int word_count);
+unsigned long long word_list_fingerprint(char **word_list, int word_count);
+double get_time_ms(void);
+void profile_reset(void);
+void profile_get(ProfileCounters *out);
 
 // Game Logic
 void init_game(GameState *game, const char *target);
@@ -49,5 +105,25 @@ int solve_game_simple(const char *target, char **word_list, int word_count,
                       bool silent);
 int solve_game_minimax(const char *target, char **word_list, int word_count,
                        bool silent);
+int solve_game_minimax_budget(const char *target, char **word_list,
+                              int word_count, bool silent, double budget_ms,
+                              bool *completed, double *max_turn_ms);
+int select_guess_anytime(char **word_list, const bool *possible,
+                         int word_count, double deadline_ms, bool *completed);
+int solve_game_with_opening(SolverStrategy strategy, const char *target,
+                            char **word_list, int word_count,
+                            const Opening *opening, double budget_ms,
+                            bool *completed, double *max_turn_ms);
+void set_solver_opening(SolverStrategy strategy, const Opening *opening);
+int get_feedback_index(const FeedbackColor *feedback);
+int get_worst_case_split(const char *guess, char **word_list,
+                         const bool *possible, int word_count);
+bool is_consistent(const char *candidate, const char *guess,
+                   const FeedbackColor *feedback);
+
+// Opener analysis
+bool run_opener_analysis(char **word_list, int word_count,
+                         const char *filename);
+bool load_opening_book(const char *filename, char **word_list, int word_count);
 
 #endif
\ No newline at end of file